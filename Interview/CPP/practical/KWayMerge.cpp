@@ -0,0 +1,449 @@
+/*
+ * ✅ K-way Merge Summary Table:
+ *    Merge Type               Time Complexity          Space Complexity    Best Use Cases
+ *    ─────────────────────────────────────────────────────────────────────────────────────────────────
+ *    Concatenate + Sort       O(n log n)               O(n)                Baseline, unsorted shards
+ *    Loser Tree               O(n log k)               O(k)                Many shards, streaming inputs
+ *    Vectorised 2-way Merge   O(n log k), k ≤ 4        O(n) for k > 2      Few shards in memory
+ *    Parallel Partitioned     O(n log k / t)           O(n)                Large in-memory merges, many cores
+ *
+ *    Modes: All keeps every element, Union keeps each distinct value once,
+ *    Intersection keeps the values present in every input (once)
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+class MergeAlgorithms {
+public:
+    enum class MergeMode { All, Union, Intersection };
+
+    // Input that yields a sorted sequence one value at a time
+    using StreamSource = function<bool(int &)>;
+
+    struct SpanSource {
+        const int *current, *end;
+        bool next(int &value) {
+            if(current == end) return false;
+            value = *current++;
+            return true;
+        }
+    };
+
+    struct StreamSourceAdapter {
+        StreamSource source;
+        bool next(int &value) { return source(value); }
+    };
+
+    static constexpr size_t kVectorMergeMaxK = 4;     // up to this many inputs use the vector kernel
+    static constexpr size_t kParallelMin = 1 << 16;   // output elements per thread worth a parallel merge
+
+    // Utility functions
+    void takeInput(int size, vector<int> &v) {
+        for(int i = 0; i < size; i++) {
+            cin >> v[i];
+        }
+    }
+
+    void display(const vector<int> &v, const string &title = "") {
+        if(!title.empty()) {
+            cout << title << ": ";
+        }
+        for(int i = 0; i < v.size(); i++) {
+            cout << v[i] << " ";
+        }
+        cout << endl;
+    }
+
+    // 1. Loser Tree - O(log k) per element, the winner is replayed against one path only.
+    //    Every node packs (exhausted, value, source) into 64 bits, so a match is a branch-free
+    //    min/max of two integers and ties go to the lower source.
+    template<typename Source, typename Sink>
+    size_t loserTreeMerge(vector<Source> &sources, Sink sink, MergeMode mode = MergeMode::All) {
+        size_t k = sources.size();
+        if(k == 0) return 0;
+        size_t leaves = 1;
+        while(leaves < k) leaves *= 2;
+
+        const uint64_t exhausted = uint64_t(1) << 32;
+        auto pack = [](uint64_t key, size_t source) { return key << 31 | source; };
+        vector<int> lastValue(k);
+        vector<char> started(k, false);
+
+        // Packed next entry of source i; Union and Intersection read each source as a set
+        auto fetch = [&](size_t i) {
+            int value;
+            while(i < k && sources[i].next(value)) {
+                if(mode != MergeMode::All) {
+                    if(started[i] && value == lastValue[i]) continue;
+                    started[i] = true;
+                    lastValue[i] = value;
+                }
+                return pack(uint32_t(value) ^ 0x80000000u, i);
+            }
+            return pack(exhausted, i);
+        };
+
+        // tree[node] holds the loser of the match at that node
+        vector<uint64_t> tree(leaves), winner(2 * leaves);
+        for(size_t i = 0; i < leaves; i++)
+            winner[leaves + i] = fetch(i);
+        for(size_t node = leaves - 1; node >= 1; node--) {
+            winner[node] = min(winner[2 * node], winner[2 * node + 1]);
+            tree[node] = max(winner[2 * node], winner[2 * node + 1]);
+        }
+        uint64_t current = winner[1];
+
+        size_t written = 0, runLength = 0;
+        uint64_t runKey = exhausted;
+        const uint64_t sourceMask = (uint64_t(1) << 31) - 1;
+        while((current >> 31) != exhausted) {
+            uint64_t key = current >> 31;
+            size_t w = current & sourceMask;
+            int value = int(uint32_t(key) ^ 0x80000000u);
+            if(mode == MergeMode::All) {
+                sink(value);
+                written++;
+            } else {
+                runLength = key == runKey ? runLength + 1 : 1;
+                runKey = key;
+                bool emit = mode == MergeMode::Union ? runLength == 1 : runLength == k;
+                if(emit) {
+                    sink(value);
+                    written++;
+                }
+            }
+
+            current = fetch(w);
+            for(size_t node = (w + leaves) / 2; node >= 1; node /= 2) {
+                // Select by mask: a compiled branch would mispredict on every other level
+                uint64_t loser = tree[node];
+                uint64_t mask = -uint64_t(loser < current);
+                uint64_t smaller = current ^ ((current ^ loser) & mask);
+                tree[node] = loser ^ current ^ smaller;
+                current = smaller;
+            }
+        }
+        return written;
+    }
+
+    // 2. Vectorised 2-way merge - a 4+4 bitonic merge network on GCC vector types
+    //    (one min/max per stage, shuffles in between); tails are merged branch-free.
+    typedef int Vec4 __attribute__((vector_size(16)));
+    typedef int Mask4 __attribute__((vector_size(16)));
+
+    static Vec4 load4(const int *p) {
+        Vec4 v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    static void store4(int *p, Vec4 v) {
+        memcpy(p, &v, sizeof(v));
+    }
+
+    static Vec4 vmin(Vec4 a, Vec4 b) { return a < b ? a : b; }
+    static Vec4 vmax(Vec4 a, Vec4 b) { return a < b ? b : a; }
+
+    // Sorts a bitonic sequence of four
+    static Vec4 bitonicClean4(Vec4 v) {
+        Vec4 p = __builtin_shuffle(v, Mask4{2, 3, 0, 1});
+        v = __builtin_shuffle(vmin(v, p), vmax(v, p), Mask4{0, 1, 6, 7});
+        p = __builtin_shuffle(v, Mask4{1, 0, 3, 2});
+        return __builtin_shuffle(vmin(v, p), vmax(v, p), Mask4{0, 5, 2, 7});
+    }
+
+    // a and b sorted; afterwards a holds the four smallest, b the four largest, both sorted
+    static void bitonicMerge4(Vec4 &a, Vec4 &b) {
+        b = __builtin_shuffle(b, Mask4{3, 2, 1, 0});
+        Vec4 low = vmin(a, b), high = vmax(a, b);
+        a = bitonicClean4(low);
+        b = bitonicClean4(high);
+    }
+
+    static size_t scalarMerge(const int *a, size_t na, const int *b, size_t nb, int *out) {
+        size_t i = 0, j = 0, o = 0;
+        while(i < na && j < nb) {
+            bool takeA = a[i] <= b[j];
+            out[o++] = takeA ? a[i] : b[j];
+            i += takeA;
+            j += !takeA;
+        }
+        while(i < na) out[o++] = a[i++];
+        while(j < nb) out[o++] = b[j++];
+        return o;
+    }
+
+    size_t vectorMerge(const int *a, size_t na, const int *b, size_t nb, int *out) {
+        if(na < 4 || nb < 4)
+            return scalarMerge(a, na, b, nb, out);
+
+        Vec4 low = load4(a), high = load4(b);
+        size_t i = 4, j = 4, o = 0;
+        while(true) {
+            bitonicMerge4(low, high);
+            store4(out + o, low);
+            o += 4;
+            // Continue with the input whose next element is smaller, while both have a full block
+            if(i + 4 > na || j + 4 > nb) break;
+            if(a[i] <= b[j]) {
+                low = load4(a + i);
+                i += 4;
+            } else {
+                low = load4(b + j);
+                j += 4;
+            }
+        }
+
+        // Everything written is <= the four held back and both tails. Each held value goes out
+        // after the tail elements smaller than it, the rest of the tails follow.
+        int held[4];
+        store4(held, high);
+        for(int h = 0; h < 4; h++) {
+            size_t ia = lower_bound(a + i, a + na, held[h]) - a;
+            size_t jb = lower_bound(b + j, b + nb, held[h]) - b;
+            o += scalarMerge(a + i, ia - i, b + j, jb - j, out + o);
+            out[o++] = held[h];
+            i = ia;
+            j = jb;
+        }
+        return o + scalarMerge(a + i, na - i, b + j, nb - j, out + o);
+    }
+
+    // Up to four inputs: pairwise vector merges
+    size_t smallKMerge(const vector<pair<const int *, size_t>> &inputs, int *out) {
+        size_t k = inputs.size();
+        if(k == 0) return 0;
+        if(k == 1) {
+            copy(inputs[0].first, inputs[0].first + inputs[0].second, out);
+            return inputs[0].second;
+        }
+        if(k == 2)
+            return vectorMerge(inputs[0].first, inputs[0].second, inputs[1].first, inputs[1].second, out);
+
+        vector<int> left(inputs[0].second + inputs[1].second);
+        vector<int> right;
+        size_t nl = vectorMerge(inputs[0].first, inputs[0].second, inputs[1].first, inputs[1].second, left.data());
+        const int *r = inputs[2].first;
+        size_t nr = inputs[2].second;
+        if(k == 4) {
+            right.resize(inputs[2].second + inputs[3].second);
+            nr = vectorMerge(inputs[2].first, inputs[2].second, inputs[3].first, inputs[3].second, right.data());
+            r = right.data();
+        }
+        return vectorMerge(left.data(), nl, r, nr, out);
+    }
+
+    // Merges in-memory inputs into out (sized for the total), returns the number written
+    size_t mergeSpans(const vector<pair<const int *, size_t>> &inputs, int *out, MergeMode mode = MergeMode::All) {
+        if(inputs.size() <= kVectorMergeMaxK && mode != MergeMode::Intersection) {
+            size_t n = smallKMerge(inputs, out);
+            if(mode == MergeMode::Union)
+                n = unique(out, out + n) - out;
+            return n;
+        }
+        vector<SpanSource> sources;
+        for(auto &input : inputs)
+            sources.push_back({input.first, input.first + input.second});
+        int *write = out;
+        return loserTreeMerge(sources, [&](int value) { *write++ = value; }, mode);
+    }
+
+    vector<int> kWayMerge(const vector<vector<int>> &shards, MergeMode mode = MergeMode::All) {
+        vector<pair<const int *, size_t>> inputs;
+        size_t total = 0;
+        for(auto &shard : shards) {
+            inputs.push_back({shard.data(), shard.size()});
+            total += shard.size();
+        }
+        vector<int> out(total);
+        out.resize(mergeSpans(inputs, out.data(), mode));
+        return out;
+    }
+
+    // Streaming inputs: values go straight to the sink, nothing is buffered
+    size_t kWayMergeStreams(vector<StreamSource> streams, const function<void(int)> &sink, MergeMode mode = MergeMode::All) {
+        vector<StreamSourceAdapter> sources;
+        for(auto &stream : streams)
+            sources.push_back({move(stream)});
+        return loserTreeMerge(sources, sink, mode);
+    }
+
+    // 3. Parallel Partitioned Merge - splitter keys sampled from the inputs cut every input
+    //    with lower_bound, so each thread merges independent slices into its own output range.
+    //    Equal values never straddle a cut, which keeps Union and Intersection exact.
+    vector<int> parallelKWayMerge(const vector<vector<int>> &shards, MergeMode mode = MergeMode::All, int threads = 0) {
+        if(threads <= 0) threads = max(1u, thread::hardware_concurrency());
+        size_t total = 0;
+        for(auto &shard : shards) total += shard.size();
+        threads = min<size_t>(threads, total / kParallelMin);
+        if(threads <= 1)
+            return kWayMerge(shards, mode);
+
+        // Evenly spaced samples from every shard, weighted by its size; shards shorter than
+        // the step still give one, so hundreds of small shards are sampled too
+        size_t step = max<size_t>(1, total / (threads * 64));
+        vector<int> samples;
+        for(auto &shard : shards)
+            for(size_t i = min(step / 2, shard.size() - 1); i < shard.size(); i += step)
+                samples.push_back(shard[i]);
+        if(samples.empty())
+            return kWayMerge(shards, mode);
+        sort(samples.begin(), samples.end());
+        vector<int> splitters;
+        for(int t = 1; t < threads; t++)
+            splitters.push_back(samples[samples.size() * t / threads]);
+
+        // cut[p][s]: where part p starts in shard s
+        size_t k = shards.size();
+        vector<vector<size_t>> cut(threads + 1, vector<size_t>(k));
+        for(size_t s = 0; s < k; s++) {
+            cut[0][s] = 0;
+            for(int p = 1; p < threads; p++)
+                cut[p][s] = lower_bound(shards[s].begin(), shards[s].end(), splitters[p - 1]) - shards[s].begin();
+            cut[threads][s] = shards[s].size();
+        }
+        vector<size_t> offset(threads + 1, 0);
+        for(int p = 0; p < threads; p++) {
+            offset[p + 1] = offset[p];
+            for(size_t s = 0; s < k; s++)
+                offset[p + 1] += cut[p + 1][s] - cut[p][s];
+        }
+
+        vector<int> out(total);
+        vector<size_t> written(threads);
+        vector<thread> workers;
+        for(int p = 0; p < threads; p++) {
+            workers.emplace_back([&, p]() {
+                vector<pair<const int *, size_t>> inputs;
+                for(size_t s = 0; s < k; s++)
+                    if(cut[p + 1][s] > cut[p][s])
+                        inputs.push_back({shards[s].data() + cut[p][s], cut[p + 1][s] - cut[p][s]});
+                // A part missing some shard has no value common to all of them
+                if(mode == MergeMode::Intersection && inputs.size() < k)
+                    written[p] = 0;
+                else
+                    written[p] = mergeSpans(inputs, out.data() + offset[p], mode);
+            });
+        }
+        for(auto &w : workers) w.join();
+
+        // Close the gaps left by parts that dropped duplicates
+        size_t size = written[0];
+        for(int p = 1; p < threads; p++) {
+            if(size != offset[p])
+                copy(out.begin() + offset[p], out.begin() + offset[p] + written[p], out.begin() + size);
+            size += written[p];
+        }
+        out.resize(size);
+        return out;
+    }
+
+    // Performance testing function: k sorted shards of random values, total n elements
+    // (threads = 0 uses every core for the parallel merge)
+    void testMergePerformance(int n, int k, MergeMode mode = MergeMode::All, int threads = 0) {
+        cout << "\n=== K-WAY MERGE PERFORMANCE TEST (n = " << n << ", k = " << k << ") ===\n";
+
+        mt19937 rng(42);
+        vector<vector<int>> shards(k);
+        for(int i = 0; i < n; i++)
+            shards[rng() % k].push_back(rng() % (n / 2 + 1));
+        for(auto &shard : shards)
+            sort(shard.begin(), shard.end());
+
+        vector<pair<string, function<vector<int>()>>> algorithms = {
+            {"Concatenate + Sort", [&]() {
+                // Intersection has no use for the concatenation: pairwise set_intersection instead
+                if(mode == MergeMode::Intersection) {
+                    vector<int> common = shards[0];
+                    common.erase(unique(common.begin(), common.end()), common.end());
+                    for(int s = 1; s < k; s++) {
+                        vector<int> next;
+                        set_intersection(common.begin(), common.end(), shards[s].begin(), shards[s].end(), back_inserter(next));
+                        common.swap(next);
+                    }
+                    return common;
+                }
+                vector<int> all;
+                for(auto &shard : shards) all.insert(all.end(), shard.begin(), shard.end());
+                sort(all.begin(), all.end());
+                if(mode == MergeMode::Union)
+                    all.erase(unique(all.begin(), all.end()), all.end());
+                return all;
+            }},
+            {"Loser Tree", [&]() {
+                vector<SpanSource> sources;
+                for(auto &shard : shards) sources.push_back({shard.data(), shard.data() + shard.size()});
+                vector<int> out;
+                out.reserve(n);
+                loserTreeMerge(sources, [&](int value) { out.push_back(value); }, mode);
+                return out;
+            }},
+            {"K-way Merge (auto)", [&]() { return kWayMerge(shards, mode); }},
+            {"Parallel Partitioned Merge", [&]() { return parallelKWayMerge(shards, mode, threads); }}
+        };
+
+        // The first algorithm's output is the reference, whatever its size
+        vector<int> expected;
+        bool haveExpected = false;
+        for(auto& algo : algorithms) {
+            auto start = chrono::high_resolution_clock::now();
+            vector<int> result = algo.second();
+            auto end = chrono::high_resolution_clock::now();
+            auto duration = chrono::duration_cast<chrono::microseconds>(end - start);
+
+            if(!haveExpected) {
+                expected = result;
+                haveExpected = true;
+            }
+            cout << algo.first << " took: " << duration.count() << " microseconds, output: " << result.size()
+                 << (result == expected ? "" : " (MISMATCH)") << "\n";
+        }
+    }
+};
+
+int main() {
+    MergeAlgorithms merger;
+    int k;
+
+    // cout << "Enter number of shards: ";
+    cin >> k;
+
+    // Each shard: its size followed by its elements (sorted here if they are not)
+    vector<vector<int>> shards(k);
+    for(int s = 0; s < k; s++) {
+        int size;
+        cin >> size;
+        shards[s].resize(size);
+        merger.takeInput(size, shards[s]);
+        sort(shards[s].begin(), shards[s].end());
+        merger.display(shards[s], "Shard " + to_string(s));
+    }
+
+    cout << "\n=== K-WAY MERGE DEMONSTRATIONS ===\n";
+
+    merger.display(merger.kWayMerge(shards), "Merge (all)");
+    merger.display(merger.kWayMerge(shards, MergeAlgorithms::MergeMode::Union), "Union");
+    merger.display(merger.kWayMerge(shards, MergeAlgorithms::MergeMode::Intersection), "Intersection");
+    merger.display(merger.parallelKWayMerge(shards), "Parallel Merge");
+
+    vector<MergeAlgorithms::StreamSource> streams;
+    for(auto &shard : shards) {
+        size_t position = 0;
+        const vector<int> *data = &shard;
+        streams.push_back([data, position](int &value) mutable {
+            if(position == data->size()) return false;
+            value = (*data)[position++];
+            return true;
+        });
+    }
+    cout << "Streaming Merge: ";
+    merger.kWayMergeStreams(streams, [](int value) { cout << value << " "; });
+    cout << endl;
+
+    // Performance test (uncomment for larger datasets)
+    // merger.testMergePerformance(10000000, 256);
+    // merger.testMergePerformance(200000, 2000, MergeAlgorithms::MergeMode::All, 4);    // many small shards
+
+    return 0;
+}
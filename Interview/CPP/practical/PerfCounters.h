@@ -0,0 +1,262 @@
+/*
+ * ✅ Hardware Performance Counters for the practical benchmarks (Linux perf_event_open)
+ *    Counter             What a high value points at
+ *    ─────────────────────────────────────────────────────────────────────────────
+ *    cycles              Total cost on the core
+ *    instructions        Work done; instructions / cycles = IPC
+ *    L1D misses          Working set or access pattern too big/random for L1
+ *    LLC misses          Trips to main memory
+ *    branch misses       Data-dependent branches the predictor cannot learn
+ *
+ *    PerfProfiler measures a whole run; PerfScope("name") inside an algorithm adds a phase
+ *    (e.g. partition vs recursion, index build vs query). Only outermost scopes are recorded,
+ *    and scopes cost nothing while no profiler is running.
+ *    Counters cover the calling thread only. A worker thread is counted when it runs inside a
+ *    PerfThreadScope: it opens its own counters and adds them to the profiler before it returns,
+ *    so they are included once the thread is joined. Threads started without one are not counted.
+ *    Counters that cannot be opened (no PMU in a VM, perf_event_paranoid, non-Linux)
+ *    are reported as n/a.
+ */
+
+#pragma once
+
+#include <bits/stdc++.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+struct PerfSample {
+    static const int kEvents = 5;
+
+    // Raw counter readings; values are only comparable through operator-
+    long long value[kEvents] = {0};
+    long long enabled[kEvents] = {0};
+    long long running[kEvents] = {0};
+    bool valid[kEvents] = {false};
+
+    PerfSample operator-(const PerfSample &start) const {
+        PerfSample delta;
+        for(int i = 0; i < kEvents; i++) {
+            delta.valid[i] = valid[i] && start.valid[i];
+            delta.value[i] = value[i] - start.value[i];
+            delta.enabled[i] = enabled[i] - start.enabled[i];
+            delta.running[i] = running[i] - start.running[i];
+        }
+        return delta;
+    }
+
+    PerfSample &operator+=(const PerfSample &other) {
+        for(int i = 0; i < kEvents; i++) {
+            valid[i] = valid[i] || other.valid[i];
+            value[i] += other.value[i];
+            enabled[i] += other.enabled[i];
+            running[i] += other.running[i];
+        }
+        return *this;
+    }
+
+    // Count of event i, scaled up when the kernel had to multiplex the counters; -1 if unavailable
+    double count(int i) const {
+        if(!valid[i]) return -1;
+        if(running[i] <= 0) return enabled[i] > 0 ? -1 : 0;
+        return double(value[i]) * enabled[i] / running[i];
+    }
+
+    static string formatCount(double c) {
+        if(c < 0) return "n/a";
+        ostringstream out;
+        out << fixed << setprecision(1);
+        if(c >= 1e9) out << c / 1e9 << "G";
+        else if(c >= 1e6) out << c / 1e6 << "M";
+        else if(c >= 1e3) out << c / 1e3 << "K";
+        else out << setprecision(0) << c;
+        return out.str();
+    }
+
+    // "cycles 1.2M | instructions 3.0M | IPC 2.50 | L1D misses 10.0K | LLC misses 120 | branch misses 4.1K"
+    string summary() const {
+        static const char *names[kEvents] = {"cycles", "instructions", "L1D misses", "LLC misses", "branch misses"};
+        ostringstream out;
+        for(int i = 0; i < kEvents; i++) {
+            if(i > 0) out << " | ";
+            out << names[i] << " " << formatCount(count(i));
+            if(i == 1) {
+                out << " | IPC ";
+                if(count(0) > 0 && count(1) >= 0) out << fixed << setprecision(2) << count(1) / count(0);
+                else out << "n/a";
+            }
+        }
+        return out.str();
+    }
+};
+
+class PerfCounters {
+public:
+    PerfCounters() {
+        fill(begin(fds), end(fds), -1);
+#ifdef __linux__
+        const pair<uint32_t, uint64_t> events[PerfSample::kEvents] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}
+        };
+        for(int i = 0; i < PerfSample::kEvents; i++) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = events[i].first;
+            attr.config = events[i].second;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+            if(fds[i] < 0 && error.empty())
+                error = strerror(errno);
+        }
+#else
+        error = "perf_event_open is Linux only";
+#endif
+    }
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for(int fd : fds)
+            if(fd >= 0) close(fd);
+#endif
+    }
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    bool available() const {
+        return any_of(begin(fds), end(fds), [](int fd) { return fd >= 0; });
+    }
+
+    // Why the first counter failed to open, empty if all opened
+    const string &lastError() const { return error; }
+
+    PerfSample read() const {
+        PerfSample sample;
+#ifdef __linux__
+        for(int i = 0; i < PerfSample::kEvents; i++) {
+            long long buffer[3];
+            if(fds[i] >= 0 && ::read(fds[i], buffer, sizeof(buffer)) == sizeof(buffer)) {
+                sample.value[i] = buffer[0];
+                sample.enabled[i] = buffer[1];
+                sample.running[i] = buffer[2];
+                sample.valid[i] = true;
+            }
+        }
+#endif
+        return sample;
+    }
+
+private:
+    int fds[PerfSample::kEvents];
+    string error;
+};
+
+class PerfProfiler {
+public:
+    PerfCounters counters;
+    vector<pair<string, PerfSample>> phases;    // in order of first appearance
+    int openScopes = 0;
+
+    static PerfProfiler *&current() {
+        static PerfProfiler *profiler = nullptr;
+        return profiler;
+    }
+
+    void begin() {
+        phases.clear();
+        openScopes = 0;
+        workers = PerfSample();
+        current() = this;
+        start = read();
+    }
+
+    PerfSample end() {
+        PerfSample total = read() - start;
+        current() = nullptr;
+        return total;
+    }
+
+    // This thread's counters plus everything finished worker threads have added
+    PerfSample read() {
+        PerfSample sample = counters.read();
+        lock_guard<mutex> guard(workersLock);
+        sample += workers;
+        return sample;
+    }
+
+    void addWorker(const PerfSample &sample) {
+        lock_guard<mutex> guard(workersLock);
+        workers += sample;
+    }
+
+    void addPhase(const string &name, const PerfSample &sample) {
+        for(auto &phase : phases) {
+            if(phase.first == name) {
+                phase.second += sample;
+                return;
+            }
+        }
+        phases.push_back({name, sample});
+    }
+
+private:
+    PerfSample start;
+    PerfSample workers;
+    mutex workersLock;
+};
+
+class PerfScope {
+public:
+    explicit PerfScope(const char *phase) : profiler(PerfProfiler::current()), name(phase) {
+        if(!profiler) return;
+        recording = profiler->openScopes++ == 0;
+        if(recording) start = profiler->read();
+    }
+
+    ~PerfScope() {
+        if(!profiler) return;
+        if(recording) profiler->addPhase(name, profiler->read() - start);
+        profiler->openScopes--;
+    }
+
+    PerfScope(const PerfScope &) = delete;
+    PerfScope &operator=(const PerfScope &) = delete;
+
+private:
+    PerfProfiler *profiler;
+    const char *name;
+    bool recording = false;
+    PerfSample start;
+};
+
+// Counts the enclosing worker thread into the running profiler, if there is one
+class PerfThreadScope {
+public:
+    PerfThreadScope() : profiler(PerfProfiler::current()) {
+        if(!profiler) return;
+        counters.reset(new PerfCounters());
+        start = counters->read();
+    }
+
+    ~PerfThreadScope() {
+        if(profiler) profiler->addWorker(counters->read() - start);
+    }
+
+    PerfThreadScope(const PerfThreadScope &) = delete;
+    PerfThreadScope &operator=(const PerfThreadScope &) = delete;
+
+private:
+    PerfProfiler *profiler;
+    unique_ptr<PerfCounters> counters;
+    PerfSample start;
+};
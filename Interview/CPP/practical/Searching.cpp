@@ -11,13 +11,111 @@
  *    Ternary Search        ✅ Yes             O(1)/O(log₃ n)/O(log₃ n)           O(log n)            Finding max/min in unimodal functions
  *    Hash Search           ❌ No              O(1)/O(1)/O(n)                      O(n)                Fast lookups with hash tables
  *    Peak Finding          ❌ No              O(1)/O(log n)/O(log n)              O(1)                Finding local maxima in arrays
+ *    Bloom Pre-check       ❌ No              O(1)/O(1)/O(1)                      O(n·b) bits         Rejecting absent keys before any search
+ *
+ *    b = bits per key of the filter, chosen from the target false-positive rate
  */
 
 #include <bits/stdc++.h>
+#include "PerfCounters.h"
 using namespace std;
 
+// Blocked Bloom filter (split-block layout): every key maps to one 64-byte block, a single cache
+// line, and sets one bit in each of the block's eight 64-bit words. A lookup reads one cache line
+// and tests the eight words independently, a loop the compiler turns into SIMD compares.
+class BlockedBloomFilter {
+public:
+    static const int kWords = 8;
+    static constexpr double kMaxBitsPerKey = 64;
+    
+    void build(const vector<int> &keys, double bitsPerKey) {
+        numKeys = keys.size();
+        size_t numBlocks = max<size_t>(1, ceil(numKeys * bitsPerKey / 512));
+        blocks.assign(numBlocks, Block());
+        for(int key : keys) {
+            uint64_t h = mix(key);
+            Block &block = blocks[blockIndex(h)];
+            for(int i = 0; i < kWords; i++)
+                block.words[i] |= wordMask(h, i);
+        }
+    }
+    
+    // False means the key is definitely absent
+    bool mayContain(int key) const {
+        if(blocks.empty()) return true;
+        uint64_t h = mix(key);
+        const Block &block = blocks[blockIndex(h)];
+        uint64_t missing = 0;
+        for(int i = 0; i < kWords; i++)
+            missing |= wordMask(h, i) & ~block.words[i];
+        return missing == 0;
+    }
+    
+    // False-positive rate at a given size: keys per block are Poisson distributed, and a miss
+    // passes when its bit is set in all eight words
+    static double expectedFpr(double bitsPerKey) {
+        double keysPerBlock = 512 / max(1.0, bitsPerKey);
+        double poisson = exp(-keysPerBlock), fpr = 0;
+        for(int j = 0; j < keysPerBlock * 4 + 64; j++) {
+            if(j > 0) poisson *= keysPerBlock / j;
+            fpr += poisson * pow(1 - pow(63.0 / 64, j), kWords);
+        }
+        return fpr;
+    }
+    
+    // Smallest size (bisection on the formula above) that reaches a target false-positive rate,
+    // capped at kMaxBitsPerKey
+    static double bitsPerKeyFor(double targetFpr) {
+        double low = 1, high = kMaxBitsPerKey;
+        for(int i = 0; i < 40; i++) {
+            double mid = (low + high) / 2;
+            if(expectedFpr(mid) > targetFpr) low = mid;
+            else high = mid;
+        }
+        return high;
+    }
+    
+    size_t sizeInBytes() const { return blocks.size() * sizeof(Block); }
+    double bitsPerKey() const { return numKeys ? 8.0 * sizeInBytes() / numKeys : 0; }
+    double expectedFpr() const { return blocks.empty() ? 1 : expectedFpr(bitsPerKey()); }
+    
+private:
+    struct alignas(64) Block {
+        uint64_t words[kWords] = {0};
+    };
+    
+    vector<Block> blocks;
+    size_t numKeys = 0;
+    
+    static uint64_t mix(int key) {
+        uint64_t x = uint32_t(key) + 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+    
+    size_t blockIndex(uint64_t h) const {
+        return ((h >> 32) * blocks.size()) >> 32;
+    }
+    
+    // Bit inside word i, a multiply-shift of the low hash half with a per-word odd constant
+    static uint64_t wordMask(uint64_t h, int i) {
+        static const uint32_t salt[kWords] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                              0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+        return 1ULL << ((uint32_t(h) * salt[i]) >> 26);
+    }
+};
+
 class SearchAlgorithms {
 public:
+    // Optional membership pre-check. It only describes the array passed to buildFilter(): a search
+    // on any other array, including a copy of it, skips it, since rejecting keys with another
+    // array's filter would return false negatives. The check is by address, so it costs nothing.
+    BlockedBloomFilter filter;
+    bool filterEnabled = false;
+    const int *filterData = nullptr;    // array the filter was built from; in-place edits need a rebuild
+    size_t filterSize = 0;
+    
     // Utility functions
     void takeInput(int size, vector<int> &v) {
         cout << "Enter " << size << " elements: ";
@@ -36,9 +134,49 @@ public:
         cout << endl;
     }
     
+    // Bits per key for a target false-positive rate; false if the rate is not in (0, 1)
+    bool filterBitsPerKey(double targetFpr, double &bitsPerKey) {
+        if(!(targetFpr > 0 && targetFpr < 1)) {
+            cout << "False-positive rate must be between 0 and 1!" << endl;
+            return false;
+        }
+        bitsPerKey = BlockedBloomFilter::bitsPerKeyFor(targetFpr);
+        double reached = BlockedBloomFilter::expectedFpr(bitsPerKey);
+        if(reached > targetFpr)
+            cout << "Target false-positive rate " << targetFpr * 100 << "% is out of reach, using the "
+                 << BlockedBloomFilter::kMaxBitsPerKey << " bits/key maximum (" << reached * 100 << "%)" << endl;
+        return true;
+    }
+    
+    void buildFilter(const vector<int> &v, double targetFpr = 0.01) {
+        double bitsPerKey;
+        if(!filterBitsPerKey(targetFpr, bitsPerKey)) return;
+        filter.build(v, bitsPerKey);
+        filterEnabled = true;
+        filterData = v.data();
+        filterSize = v.size();
+        ostringstream out;
+        out << fixed << setprecision(2) << filter.bitsPerKey() << " bits/key, " << filter.sizeInBytes()
+            << " bytes, expected false-positive rate " << filter.expectedFpr() * 100 << "%";
+        cout << "Membership filter built: " << out.str() << endl;
+    }
+    
+    bool rejectedByFilter(const vector<int> &v, int target) {
+        if(!filterEnabled) return false;
+        if(v.data() != filterData || v.size() != filterSize) {
+            cout << "Membership filter was built for a different array, pre-check skipped" << endl;
+            return false;
+        }
+        if(filter.mayContain(target)) return false;
+        cout << "Element " << target << " rejected by membership filter (definitely not present)" << endl;
+        return true;
+    }
+    
     // 1. Linear Search - O(n) time, O(1) space
     int linearSearch(const vector<int> &v, int target) {
         cout << "\n--- Linear Search ---" << endl;
+        if(rejectedByFilter(v, target)) return -1;
+        PerfScope scope("query");
         for(int i = 0; i < v.size(); i++) {
             if(v[i] == target) {
                 cout << "Element " << target << " found at index: " << i << endl;
@@ -50,11 +188,18 @@ public:
     }
     
     // 2. Binary Search - O(log n) time, O(1) space
-    int binarySearch(vector<int> v, int target) {
+    int binarySearch(const vector<int> &data, int target) {
         cout << "\n--- Binary Search ---" << endl;
-        sort(v.begin(), v.end());
+        if(rejectedByFilter(data, target)) return -1;
+        vector<int> v;
+        {
+            PerfScope scope("index build");
+            v = data;
+            sort(v.begin(), v.end());
+        }
         cout << "Sorted array: ";
         display(v);
+        PerfScope scope("query");
         
         int left = 0, right = v.size() - 1;
         int comparisons = 0;
@@ -78,11 +223,18 @@ public:
     }
     
     // 3. Jump Search - O(√n) time, O(1) space
-    int jumpSearch(vector<int> v, int target) {
+    int jumpSearch(const vector<int> &data, int target) {
         cout << "\n--- Jump Search ---" << endl;
-        sort(v.begin(), v.end());
+        if(rejectedByFilter(data, target)) return -1;
+        vector<int> v;
+        {
+            PerfScope scope("index build");
+            v = data;
+            sort(v.begin(), v.end());
+        }
         cout << "Sorted array: ";
         display(v);
+        PerfScope scope("query");
         
         int n = v.size();
         int step = sqrt(n);
@@ -116,11 +268,18 @@ public:
     }
     
     // 4. Exponential Search - O(log n) time, O(1) space
-    int exponentialSearch(vector<int> v, int target) {
+    int exponentialSearch(const vector<int> &data, int target) {
         cout << "\n--- Exponential Search ---" << endl;
-        sort(v.begin(), v.end());
+        if(rejectedByFilter(data, target)) return -1;
+        vector<int> v;
+        {
+            PerfScope scope("index build");
+            v = data;
+            sort(v.begin(), v.end());
+        }
         cout << "Sorted array: ";
         display(v);
+        PerfScope scope("query");
         
         int n = v.size();
         if(v[0] == target) {
@@ -159,11 +318,18 @@ public:
     }
     
     // 5. Interpolation Search - O(log log n) average, O(n) worst case
-    int interpolationSearch(vector<int> v, int target) {
+    int interpolationSearch(const vector<int> &data, int target) {
         cout << "\n--- Interpolation Search ---" << endl;
-        sort(v.begin(), v.end());
+        if(rejectedByFilter(data, target)) return -1;
+        vector<int> v;
+        {
+            PerfScope scope("index build");
+            v = data;
+            sort(v.begin(), v.end());
+        }
         cout << "Sorted array: ";
         display(v);
+        PerfScope scope("query");
         
         int left = 0, right = v.size() - 1;
         int probes = 0;
@@ -198,11 +364,18 @@ public:
     }
     
     // 6. Fibonacci Search - O(log n) time, O(1) space
-    int fibonacciSearch(vector<int> v, int target) {
+    int fibonacciSearch(const vector<int> &data, int target) {
         cout << "\n--- Fibonacci Search ---" << endl;
-        sort(v.begin(), v.end());
+        if(rejectedByFilter(data, target)) return -1;
+        vector<int> v;
+        {
+            PerfScope scope("index build");
+            v = data;
+            sort(v.begin(), v.end());
+        }
         cout << "Sorted array: ";
         display(v);
+        PerfScope scope("query");
         
         int n = v.size();
         int fib2 = 0; // (m-2)'th Fibonacci number
@@ -249,7 +422,7 @@ public:
     }
     
     // 7. Ternary Search - O(log₃ n) time, O(log n) space
-    int ternarySearch(vector<int> v, int target, int left, int right) {
+    int ternarySearch(const vector<int> &v, int target, int left, int right) {
         if(right >= left) {
             int mid1 = left + (right - left) / 3;
             int mid2 = right - (right - left) / 3;
@@ -270,11 +443,18 @@ public:
         return -1;
     }
     
-    int ternarySearch(vector<int> v, int target) {
+    int ternarySearch(const vector<int> &data, int target) {
         cout << "\n--- Ternary Search ---" << endl;
-        sort(v.begin(), v.end());
+        if(rejectedByFilter(data, target)) return -1;
+        vector<int> v;
+        {
+            PerfScope scope("index build");
+            v = data;
+            sort(v.begin(), v.end());
+        }
         cout << "Sorted array: ";
         display(v);
+        PerfScope scope("query");
         
         int result = ternarySearch(v, target, 0, v.size() - 1);
         if(result != -1) {
@@ -288,14 +468,19 @@ public:
     // 8. Hash-based Search (using unordered_map) - O(1) average time
     int hashSearch(const vector<int> &v, int target) {
         cout << "\n--- Hash Search ---" << endl;
+        if(rejectedByFilter(v, target)) return -1;
         unordered_map<int, vector<int>> hashMap;
         
         // Build hash table
-        for(int i = 0; i < v.size(); i++) {
-            hashMap[v[i]].push_back(i);
+        {
+            PerfScope scope("index build");
+            for(int i = 0; i < v.size(); i++) {
+                hashMap[v[i]].push_back(i);
+            }
         }
         
         cout << "Hash table built with " << hashMap.size() << " unique elements" << endl;
+        PerfScope scope("query");
         
         if(hashMap.find(target) != hashMap.end()) {
             cout << "Element " << target << " found at indices: ";
@@ -332,7 +517,7 @@ public:
     }
     
     // Performance testing function
-    void testSearchPerformance(vector<int> original, int target) {
+    void testSearchPerformance(const vector<int> &original, int target) {
         cout << "\n=== SEARCH PERFORMANCE TEST ===\n";
         cout << "Searching for element: " << target << endl;
         
@@ -340,6 +525,11 @@ public:
         auto end = chrono::high_resolution_clock::now();
         auto duration = chrono::duration_cast<chrono::microseconds>(end - start);
         
+        PerfProfiler profiler;
+        bool haveCounters = profiler.counters.available();
+        if(!haveCounters)
+            cout << "(hardware counters unavailable: " << profiler.counters.lastError() << ")" << endl;
+        
         // Test each search algorithm
         vector<pair<string, function<int()>>> algorithms = {
             {"Linear Search", [&]() { return linearSearch(original, target); }},
@@ -356,15 +546,99 @@ public:
         cout << "─────────────────────────────" << endl;
         
         for(auto& algo : algorithms) {
+            profiler.begin();
             start = chrono::high_resolution_clock::now();
             int result = algo.second();
             end = chrono::high_resolution_clock::now();
+            PerfSample counters = profiler.end();
             duration = chrono::duration_cast<chrono::microseconds>(end - start);
             
             cout << algo.first << " - Time: " << duration.count() << " μs, Result: " << (result != -1 ? "Found" : "Not Found") << endl;
+            if(!haveCounters) continue;
+            cout << "    " << counters.summary() << endl;
+            for(auto& phase : profiler.phases)
+                cout << "    [" << phase.first << "] " << phase.second.summary() << endl;
         }
     }
     
+    // Filter test on a query mix where `missRatio` of the queries are absent keys. Uses quiet
+    // lookups (no printing) so the numbers show the search itself.
+    void testFilterPerformance(const vector<int> &v, double targetFpr, double missRatio, int queries) {
+        cout << "\n=== MEMBERSHIP FILTER PERFORMANCE TEST ===\n";
+        if(v.empty()) {
+            cout << "Array is empty!" << endl;
+            return;
+        }
+        if(queries <= 0 || !(missRatio >= 0 && missRatio <= 1)) {
+            cout << "Need a positive number of queries and a miss ratio between 0 and 1!" << endl;
+            return;
+        }
+        double bitsPerKey;
+        if(!filterBitsPerKey(targetFpr, bitsPerKey)) return;
+        
+        ios_base::fmtflags flags = cout.flags();
+        streamsize precision = cout.precision();
+        BlockedBloomFilter bloom;
+        auto start = chrono::high_resolution_clock::now();
+        bloom.build(v, bitsPerKey);
+        auto end = chrono::high_resolution_clock::now();
+        auto buildTime = chrono::duration_cast<chrono::microseconds>(end - start);
+        
+        // Query mix: absent keys are random values checked against the array
+        unordered_set<int> present(v.begin(), v.end());
+        mt19937 rng(42);
+        vector<int> mix(queries);
+        int misses = 0;
+        for(int &q : mix) {
+            if(uniform_real_distribution<double>(0, 1)(rng) < missRatio) {
+                do { q = rng(); } while(present.count(q));
+                misses++;
+            } else {
+                q = v[rng() % v.size()];
+            }
+        }
+        
+        int falsePositives = 0;
+        for(int q : mix)
+            if(!present.count(q) && bloom.mayContain(q)) falsePositives++;
+        
+        cout << "Keys: " << v.size() << ", queries: " << queries << " (" << misses << " misses)" << endl;
+        cout << fixed << setprecision(2) << "Filter: " << bloom.bitsPerKey() << " bits/key, "
+             << bloom.sizeInBytes() << " bytes, built in " << buildTime.count() << " μs" << endl;
+        cout << setprecision(4) << "False-positive rate: target " << targetFpr * 100 << "%, expected "
+             << bloom.expectedFpr() * 100 << "%, measured " << (misses ? 100.0 * falsePositives / misses : 0) << "%" << endl;
+        
+        vector<int> sorted = v;
+        sort(sorted.begin(), sorted.end());
+        vector<pair<string, function<bool(int)>>> lookups = {
+            {"Linear Search", [&](int q) { return find(v.begin(), v.end(), q) != v.end(); }},
+            {"Binary Search", [&](int q) { return binary_search(sorted.begin(), sorted.end(), q); }},
+            {"Hash Search", [&](int q) { return present.count(q) > 0; }}
+        };
+        
+        cout << "\nPerformance Results:" << endl;
+        cout << "─────────────────────────────" << endl;
+        
+        for(auto& lookup : lookups) {
+            int found = 0, foundFiltered = 0;
+            start = chrono::high_resolution_clock::now();
+            for(int q : mix) found += lookup.second(q);
+            end = chrono::high_resolution_clock::now();
+            auto plain = chrono::duration_cast<chrono::microseconds>(end - start);
+            
+            start = chrono::high_resolution_clock::now();
+            for(int q : mix) foundFiltered += bloom.mayContain(q) && lookup.second(q);
+            end = chrono::high_resolution_clock::now();
+            auto filtered = chrono::duration_cast<chrono::microseconds>(end - start);
+            
+            cout << setprecision(2) << lookup.first << " - Plain: " << plain.count() << " μs, With filter: " << filtered.count()
+                 << " μs, Speedup: " << (filtered.count() ? double(plain.count()) / filtered.count() : 0) << "x"
+                 << (found == foundFiltered ? "" : " (RESULTS DIFFER)") << endl;
+        }
+        cout.flags(flags);
+        cout.precision(precision);
+    }
+    
     // Interactive menu system
     void showMenu() {
         cout << "\n=== SEARCH ALGORITHMS MENU ===" << endl;
@@ -378,6 +652,8 @@ public:
         cout << "8. Hash Search" << endl;
         cout << "9. Peak Element Finding" << endl;
         cout << "10. Performance Test (All Algorithms)" << endl;
+        cout << "11. Toggle Membership Filter Pre-check (currently " << (filterEnabled ? "on" : "off") << ")" << endl;
+        cout << "12. Membership Filter Performance Test" << endl;
         cout << "0. Exit" << endl;
         cout << "Choose an option: ";
     }
@@ -451,6 +727,25 @@ int main() {
                 cin >> target;
                 searcher.testSearchPerformance(v, target);
                 break;
+            case 11:
+                if(searcher.filterEnabled) {
+                    searcher.filterEnabled = false;
+                    cout << "Membership filter disabled" << endl;
+                } else {
+                    double fpr;
+                    cout << "Enter target false-positive rate (e.g. 0.01): ";
+                    cin >> fpr;
+                    searcher.buildFilter(v, fpr);
+                }
+                break;
+            case 12: {
+                double fpr, missRatio;
+                int queries;
+                cout << "Enter target false-positive rate, miss ratio and number of queries (e.g. 0.01 0.9 100000): ";
+                cin >> fpr >> missRatio >> queries;
+                searcher.testFilterPerformance(v, fpr, missRatio, queries);
+                break;
+            }
             case 0:
                 cout << "Goodbye!" << endl;
                 break;
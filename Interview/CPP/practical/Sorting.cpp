@@ -10,9 +10,15 @@
  *    Heap Sort           No        O(n log n)/O(n log n)/O(n log n)    O(1)                Guaranteed O(n log n), memory constrained
  *    Counting Sort       Yes       O(n+k)/O(n+k)/O(n+k)               O(k)                Small range integers
  *    Radix Sort          Yes       O(d(n+k))/O(d(n+k))/O(d(n+k))      O(n+k)              Non-negative integers
+ *    Sample Sort (IPS4o) No        O(n log n)/O(n log n)/O(n log n)*   O(t·k·B)            Large arrays, many cores, tight memory
+ *    Argsort (radix)     Yes       O(4n)/O(4n)/O(4n)                  O(n)                Sorting records by key, payloads move once
+ *    Argsort (merge)     Yes       O(n log n)/O(n log n)/O(n log n)    O(n)                Same, without radix passes
+ *
+ *    * expected, splitters come from a random sample; t = threads, k = buckets, B = block size
  */
 
 #include <bits/stdc++.h>
+#include "PerfCounters.h"
 using namespace std;
 
 class SortingAlgorithms {
@@ -128,7 +134,16 @@ public:
     }
     
     void mergeSort(vector<int> &arr) {
-        mergeSort(arr, 0, arr.size() - 1);
+        if(arr.size() < 2) return;
+        int right = arr.size() - 1;
+        int mid = right / 2;
+        {
+            PerfScope scope("recursion");
+            mergeSort(arr, 0, mid);
+            mergeSort(arr, mid + 1, right);
+        }
+        PerfScope scope("final merge");
+        merge(arr, 0, mid, right);
     }
     
     // 5. Quick Sort - O(n log n) average, O(n²) worst case time, O(log n) space
@@ -155,7 +170,16 @@ public:
     }
     
     void quickSort(vector<int> &arr) {
-        quickSort(arr, 0, arr.size() - 1);
+        if(arr.size() < 2) return;
+        int high = arr.size() - 1;
+        int pi;
+        {
+            PerfScope scope("partition");
+            pi = partition(arr, 0, high);
+        }
+        PerfScope scope("recursion");
+        quickSort(arr, 0, pi - 1);
+        quickSort(arr, pi + 1, high);
     }
     
     // 6. Heap Sort - O(n log n) time, O(1) space
@@ -249,6 +273,441 @@ public:
             countingSortForRadix(arr, exp);
     }
     
+    // 9. In-place Parallel Super Scalar Sample Sort (IPS4o-style) - O(n log n) expected time, O(t·k·B) extra space
+    //    Each step splits the range into up to 2k buckets at once: k-1 splitters from a random
+    //    sample form an implicit search tree that is walked without branches, and every splitter
+    //    gets an equality bucket so duplicate keys never need another pass. Elements are collected
+    //    in per-thread buffer blocks, full blocks are written back into the input and then permuted
+    //    into their buckets block by block. Only the buffers are extra memory, independent of n.
+    static constexpr int kSampleLogBuckets = 7;              // up to 128 buckets + 128 equality buckets
+    static constexpr size_t kSampleBlockSize = 256;          // elements per block (1 KiB of ints)
+    static constexpr size_t kSampleBaseCase = 32;            // insertion sort below this size
+    static constexpr size_t kSampleParallelMin = 1 << 16;    // elements per thread worth a parallel step
+
+    struct SampleSortClassifier {
+        int logBuckets = 0;      // log2 of k
+        int numBuckets = 0;      // 2k, bucket 2i+1 holds the elements equal to splitters[i]
+        vector<int> tree;        // splitters in Eytzinger layout, tree[1..k-1]
+        vector<int> splitters;   // sorted splitters, padded with the largest one to k entries
+
+        int bucketOf(int x) const {
+            size_t j = 1;
+            for(int l = 0; l < logBuckets; l++)
+                j = 2 * j + (tree[j] < x);
+            int i = j - (1 << logBuckets);
+            return 2 * i + (x == splitters[i]);
+        }
+
+        // Eight independent tree walks side by side keep the pipeline busy instead of
+        // waiting on one chain of dependent loads
+        void classify(const int *in, size_t count, int *out) const {
+            size_t i = 0;
+            for(; i + 8 <= count; i += 8) {
+                size_t j[8];
+                for(int u = 0; u < 8; u++) j[u] = 1;
+                for(int l = 0; l < logBuckets; l++)
+                    for(int u = 0; u < 8; u++)
+                        j[u] = 2 * j[u] + (tree[j[u]] < in[i + u]);
+                for(int u = 0; u < 8; u++) {
+                    int b = j[u] - (1 << logBuckets);
+                    out[i + u] = 2 * b + (in[i + u] == splitters[b]);
+                }
+            }
+            for(; i < count; i++)
+                out[i] = bucketOf(in[i]);
+        }
+
+        void fillTree(size_t node, size_t &next) {
+            if(node >= tree.size()) return;
+            fillTree(2 * node, next);
+            tree[node] = splitters[next++];
+            fillTree(2 * node + 1, next);
+        }
+    };
+
+    struct SampleSortWorkspace {
+        vector<int> buffer;      // one block per bucket
+        vector<size_t> fill;     // elements buffered per bucket
+        vector<size_t> count;    // elements classified per bucket
+        size_t writeEnd = 0;     // full blocks were flushed to [stripe begin, writeEnd)
+        vector<int> swapBuffer;  // two blocks for following permutation cycles
+        mt19937 rng{12345};
+        // Shared by the team, only the first workspace's are used; allocated once per sort
+        unique_ptr<mutex[]> locks;   // one per bucket, taken only when several threads permute
+        vector<int> overflow;        // last block of the array, cut off by its end
+    };
+
+    static int floorLog2(size_t n) {
+        int log = 0;
+        while(n >>= 1) log++;
+        return log;
+    }
+
+    // Runs fn(0..threads-1), fn(0) on the calling thread
+    static void runOnThreads(int threads, const function<void(int)> &fn) {
+        vector<thread> workers;
+        for(int t = 1; t < threads; t++) {
+            workers.emplace_back([&fn, t]() {
+                PerfThreadScope counters;
+                fn(t);
+            });
+        }
+        fn(0);
+        for(auto &w : workers) w.join();
+    }
+
+    void insertionSort(int *a, size_t n) {
+        for(size_t i = 1; i < n; i++) {
+            int key = a[i];
+            size_t j = i;
+            while(j > 0 && a[j - 1] > key) {
+                a[j] = a[j - 1];
+                j--;
+            }
+            a[j] = key;
+        }
+    }
+
+    // Moves a random sample to the front of a[0..n), sorts it and picks the splitters
+    void buildSampleClassifier(int *a, size_t n, mt19937 &rng, SampleSortClassifier &cls) {
+        int logK = min(kSampleLogBuckets, max(1, floorLog2(n / kSampleBaseCase)));
+        size_t k = size_t(1) << logK;
+        size_t oversampling = max(1, floorLog2(n) / 5);
+        size_t sampleSize = min(n, oversampling * k - 1);
+
+        for(size_t i = 0; i < sampleSize; i++)
+            swap(a[i], a[i + rng() % (n - i)]);
+        sort(a, a + sampleSize);
+
+        cls.splitters.clear();
+        for(size_t j = 1; j < k; j++) {
+            int s = a[j * oversampling - 1];
+            if(cls.splitters.empty() || cls.splitters.back() != s)
+                cls.splitters.push_back(s);
+        }
+        int largest = cls.splitters.back();
+        cls.splitters.resize(k, largest);
+        cls.logBuckets = logK;
+        cls.numBuckets = 2 * k;
+        cls.tree.assign(k, 0);
+        size_t next = 0;
+        cls.fillTree(1, next);
+    }
+
+    // Splits a[0..n) into buckets in place using `threads` threads, returns the bucket boundaries
+    vector<size_t> sampleSortPartition(int *a, size_t n, SampleSortWorkspace *ws, int threads) {
+        const size_t B = kSampleBlockSize;
+        SampleSortClassifier cls;
+        buildSampleClassifier(a, n, ws[0].rng, cls);
+        int K = cls.numBuckets;
+
+        // Phase 1: each thread classifies its stripe, flushing full buffer blocks back
+        // into the front of the stripe. Stripes start on block boundaries.
+        size_t numBlocks = n / B;
+        vector<size_t> stripeBegin(threads + 1);
+        for(int t = 0; t < threads; t++)
+            stripeBegin[t] = numBlocks * t / threads * B;
+        stripeBegin[threads] = n;
+
+        runOnThreads(threads, [&](int t) {
+            SampleSortWorkspace &w = ws[t];
+            w.buffer.resize((size_t(2) << kSampleLogBuckets) * B);
+            w.fill.assign(K, 0);
+            w.count.assign(K, 0);
+            size_t write = stripeBegin[t];
+            int values[8], buckets[8];
+            for(size_t i = stripeBegin[t]; i < stripeBegin[t + 1]; i += 8) {
+                size_t chunk = min<size_t>(8, stripeBegin[t + 1] - i);
+                copy(a + i, a + i + chunk, values);
+                cls.classify(values, chunk, buckets);
+                for(size_t u = 0; u < chunk; u++) {
+                    int b = buckets[u];
+                    int *block = w.buffer.data() + b * B;
+                    if(w.fill[b] == B) {
+                        copy(block, block + B, a + write);
+                        write += B;
+                        w.fill[b] = 0;
+                    }
+                    block[w.fill[b]++] = values[u];
+                    w.count[b]++;
+                }
+            }
+            w.writeEnd = write;
+        });
+
+        // Bucket boundaries; bucket b permutes its blocks inside [alignedStart[b], alignedStart[b+1])
+        vector<size_t> bucketStart(K + 1, 0), alignedStart(K + 1);
+        for(int b = 0; b < K; b++) {
+            size_t total = 0;
+            for(int t = 0; t < threads; t++) total += ws[t].count[b];
+            bucketStart[b + 1] = bucketStart[b] + total;
+        }
+        for(int b = 0; b <= K; b++)
+            alignedStart[b] = (bucketStart[b] + B - 1) / B * B;
+
+        // Phase 2: inside every bucket region, move full blocks in front of the empty ones
+        // (a region may span several stripes, each ending in empty blocks)
+        auto isFull = [&](size_t pos) {
+            int t = upper_bound(stripeBegin.begin(), stripeBegin.end() - 1, pos) - stripeBegin.begin() - 1;
+            return pos + B <= ws[t].writeEnd;
+        };
+        vector<size_t> writePtr(K), readPtr(K);
+        runOnThreads(threads, [&](int t) {
+            for(int b = t; b < K; b += threads) {
+                size_t lo = alignedStart[b], hi = max(lo, min(alignedStart[b + 1], numBlocks * B));
+                while(true) {
+                    while(lo < hi && isFull(lo)) lo += B;
+                    while(hi > lo && !isFull(hi - B)) hi -= B;
+                    if(lo >= hi) break;
+                    copy(a + hi - B, a + hi, a + lo);
+                    lo += B;
+                    hi -= B;
+                }
+                writePtr[b] = alignedStart[b];
+                readPtr[b] = lo;
+            }
+        });
+
+        // Phase 3: block permutation. Blocks in [writePtr[b], readPtr[b]) are still unplaced;
+        // a thread takes one, and swaps it into its destination until it lands on an empty slot.
+        if(!ws[0].locks) {
+            ws[0].locks.reset(new mutex[size_t(2) << kSampleLogBuckets]);
+            ws[0].overflow.resize(B);
+        }
+        mutex *locks = ws[0].locks.get();
+        vector<int> &overflow = ws[0].overflow;
+        size_t overflowPos = n;
+        int overflowBucket = -1;
+        runOnThreads(threads, [&](int t) {
+            SampleSortWorkspace &w = ws[t];
+            w.swapBuffer.resize(2 * B);
+            int *current = w.swapBuffer.data(), *other = current + B;
+            for(int step = 0; step < K; step++) {
+                int b = (K * t / threads + step) % K;
+                while(true) {
+                    {
+                        unique_lock<mutex> guard(locks[b], defer_lock);
+                        if(threads > 1) guard.lock();
+                        if(readPtr[b] <= writePtr[b]) break;
+                        readPtr[b] -= B;
+                        copy(a + readPtr[b], a + readPtr[b] + B, current);
+                    }
+                    while(true) {
+                        int dest = cls.bucketOf(current[0]);
+                        unique_lock<mutex> guard(locks[dest], defer_lock);
+                        if(threads > 1) guard.lock();
+                        size_t pos = writePtr[dest];
+                        writePtr[dest] += B;
+                        if(pos < readPtr[dest]) {
+                            copy(a + pos, a + pos + B, other);
+                            copy(current, current + B, a + pos);
+                            swap(current, other);
+                            continue;
+                        }
+                        if(pos + B > n) {
+                            // The last block of the array is cut off by its end
+                            copy(current, current + B, overflow.begin());
+                            overflowPos = pos;
+                            overflowBucket = dest;
+                        } else {
+                            copy(current, current + B, a + pos);
+                        }
+                        break;
+                    }
+                }
+            }
+        });
+
+        // Phase 4: cleanup. Every bucket fills the gaps at its head and tail from the thread
+        // buffers and from its last block where that spilled into the next bucket.
+        if(overflowBucket != -1)
+            copy(overflow.begin(), overflow.begin() + (n - overflowPos), a + overflowPos);
+        for(int b = 0; b < K; b++) {
+            size_t end = bucketStart[b + 1];
+            size_t blocksBegin = alignedStart[b], blocksEnd = writePtr[b];
+            size_t pos = bucketStart[b];
+            auto place = [&](int x) {
+                if(pos == blocksBegin) pos = blocksEnd;
+                a[pos++] = x;
+            };
+            if(blocksEnd > blocksBegin)
+                for(size_t i = end; i < min(blocksEnd, n); i++)
+                    place(a[i]);
+            if(b == overflowBucket)
+                for(size_t i = n - overflowPos; i < B; i++)
+                    place(overflow[i]);
+            for(int t = 0; t < threads; t++) {
+                const int *block = ws[t].buffer.data() + b * B;
+                for(size_t i = 0; i < ws[t].fill[b]; i++)
+                    place(block[i]);
+            }
+        }
+        return bucketStart;
+    }
+
+    void sampleSortSequential(int *a, size_t n, SampleSortWorkspace &ws) {
+        if(n <= kSampleBaseCase) {
+            insertionSort(a, n);
+            return;
+        }
+        vector<size_t> bounds = sampleSortPartition(a, n, &ws, 1);
+        // Odd buckets hold copies of one splitter and are already sorted
+        for(size_t b = 0; b + 1 < bounds.size(); b += 2)
+            if(bounds[b + 1] - bounds[b] > 1)
+                sampleSortSequential(a + bounds[b], bounds[b + 1] - bounds[b], ws);
+    }
+
+    void sampleSortParallel(int *a, size_t n, int threads, vector<SampleSortWorkspace> &ws) {
+        threads = min<size_t>(threads, n / kSampleParallelMin);
+        if(threads <= 1) {
+            PerfScope scope("sequential");
+            sampleSortSequential(a, n, ws[0]);
+            return;
+        }
+        vector<size_t> bounds;
+        {
+            PerfScope scope("partition");
+            bounds = sampleSortPartition(a, n, ws.data(), threads);
+        }
+        PerfScope scope("recursion");
+
+        // Buckets larger than a thread's share are split by the whole team again,
+        // the rest are handed out largest first, one thread per bucket
+        vector<pair<size_t, size_t>> jobs;
+        for(size_t b = 0; b + 1 < bounds.size(); b += 2) {
+            size_t size = bounds[b + 1] - bounds[b];
+            if(size > n / threads)
+                sampleSortParallel(a + bounds[b], size, threads, ws);
+            else if(size > 1)
+                jobs.push_back({size, bounds[b]});
+        }
+        sort(jobs.rbegin(), jobs.rend());
+        atomic<size_t> next(0);
+        runOnThreads(threads, [&](int t) {
+            for(size_t j = next++; j < jobs.size(); j = next++)
+                sampleSortSequential(a + jobs[j].second, jobs[j].first, ws[t]);
+        });
+    }
+
+    void sampleSort(vector<int> &arr, int threads = 0) {
+        if(threads <= 0) threads = max(1u, thread::hardware_concurrency());
+        vector<SampleSortWorkspace> ws(threads);
+        sampleSortParallel(arr.data(), arr.size(), threads, ws);
+    }
+    
+    // 10. Argsort and key/payload record sorting
+    //     Sorting (key, index) pairs instead of whole records keeps the inner loops on 8-byte
+    //     items; the payloads are then moved once by applyPermutation().
+    struct KeyIndex {
+        int key;
+        int index;
+    };
+
+    vector<KeyIndex> makeKeyIndex(const vector<int> &keys) {
+        vector<KeyIndex> items(keys.size());
+        for(int i = 0; i < keys.size(); i++)
+            items[i] = {keys[i], i};
+        return items;
+    }
+
+    // LSD radix sort on the key, 8 bits per pass, stable. Flipping the sign bit makes
+    // negative keys order correctly; passes where every key has the same digit are skipped.
+    void radixSortKeyIndex(vector<KeyIndex> &items) {
+        vector<KeyIndex> buffer(items.size());
+        for(int shift = 0; shift < 32; shift += 8) {
+            size_t count[257] = {0};
+            for(const KeyIndex &item : items)
+                count[((uint32_t(item.key) ^ 0x80000000u) >> shift & 0xFF) + 1]++;
+            if(*max_element(count + 1, count + 257) == items.size()) continue;
+            for(int d = 1; d < 257; d++)
+                count[d] += count[d - 1];
+            for(const KeyIndex &item : items)
+                buffer[count[(uint32_t(item.key) ^ 0x80000000u) >> shift & 0xFF]++] = item;
+            items.swap(buffer);
+        }
+    }
+
+    // Bottom-up merge sort on the key, stable, one scratch buffer for the whole sort
+    void mergeSortKeyIndex(vector<KeyIndex> &items) {
+        size_t n = items.size();
+        vector<KeyIndex> buffer(n);
+        for(size_t width = 1; width < n; width *= 2) {
+            for(size_t left = 0; left < n; left += 2 * width) {
+                size_t mid = min(left + width, n), right = min(left + 2 * width, n);
+                size_t i = left, j = mid, k = left;
+                while(i < mid && j < right)
+                    buffer[k++] = items[j].key < items[i].key ? items[j++] : items[i++];
+                while(i < mid) buffer[k++] = items[i++];
+                while(j < right) buffer[k++] = items[j++];
+            }
+            items.swap(buffer);
+        }
+    }
+
+    // Stable permutation that sorts `keys`: keys[perm[0]] <= keys[perm[1]] <= ...
+    vector<int> argsort(const vector<int> &keys, bool useRadix = true) {
+        vector<KeyIndex> items = makeKeyIndex(keys);
+        if(useRadix)
+            radixSortKeyIndex(items);
+        else
+            mergeSortKeyIndex(items);
+        vector<int> perm(items.size());
+        for(int i = 0; i < items.size(); i++)
+            perm[i] = items[i].index;
+        return perm;
+    }
+
+    // Rearranges records so that records[i] becomes the old records[perm[i]], in place.
+    // Each cycle of the permutation is followed once, so every record is moved exactly
+    // once (plus one temporary per cycle). perm is used for marking and restored afterwards.
+    template<typename Record>
+    void applyPermutation(vector<Record> &records, vector<int> &perm) {
+        int n = perm.size();
+        for(int i = 0; i < n; i++) {
+            if(perm[i] < 0 || perm[i] == i) continue;
+            Record held = move(records[i]);
+            int j = i;
+            while(perm[j] != i) {
+                int next = perm[j];
+                records[j] = move(records[next]);
+                perm[j] = ~next;
+                j = next;
+            }
+            records[j] = move(held);
+            perm[j] = ~i;
+        }
+        for(int i = 0; i < n; i++)
+            if(perm[i] < 0) perm[i] = ~perm[i];
+    }
+
+    // Stable sort of records by an int key, payloads are touched once
+    template<typename Record, typename KeyOf>
+    void sortRecordsByKey(vector<Record> &records, KeyOf keyOf, bool useRadix = true) {
+        vector<int> keys(records.size());
+        for(int i = 0; i < records.size(); i++)
+            keys[i] = keyOf(records[i]);
+        vector<int> perm = argsort(keys, useRadix);
+        applyPermutation(records, perm);
+    }
+    
+    // Memory helpers for the performance test (Linux /proc, -1 when unavailable)
+    long readStatusKB(const string &field) {
+        ifstream status("/proc/self/status");
+        string line;
+        while(getline(status, line)) {
+            if(line.compare(0, field.size(), field) == 0)
+                return stol(line.substr(field.size() + 1));
+        }
+        return -1;
+    }
+    
+    // Resets the peak RSS (VmHWM) to the current RSS, so the next peak covers only what follows
+    bool resetPeakRSS() {
+        ofstream clearRefs("/proc/self/clear_refs");
+        clearRefs << "5";
+        return bool(clearRefs);
+    }
+    
     // Performance testing function
     void testSortingPerformance(vector<int> original) {
         cout << "\n=== SORTING PERFORMANCE TEST ===\n";
@@ -258,6 +717,13 @@ public:
         auto end = chrono::high_resolution_clock::now();
         auto duration = chrono::duration_cast<chrono::microseconds>(end - start);
         
+        ios_base::fmtflags flags = cout.flags();
+        streamsize precision = cout.precision();
+        PerfProfiler profiler;
+        bool haveCounters = profiler.counters.available();
+        if(!haveCounters)
+            cout << "(hardware counters unavailable: " << profiler.counters.lastError() << ")\n";
+        
         // Test each sorting algorithm
         vector<pair<string, function<void(vector<int>&)>>> algorithms = {
             {"Bubble Sort", [this](vector<int>& v) { bubbleSort(v); }},
@@ -267,17 +733,70 @@ public:
             {"Quick Sort", [this](vector<int>& v) { quickSort(v); }},
             {"Heap Sort", [this](vector<int>& v) { heapSort(v); }},
             {"Counting Sort", [this](vector<int>& v) { countingSort(v); }},
-            {"Radix Sort", [this](vector<int>& v) { radixSort(v); }}
+            {"Radix Sort", [this](vector<int>& v) { radixSort(v); }},
+            {"Sample Sort (IPS4o)", [this](vector<int>& v) { sampleSort(v); }}
         };
         
         for(auto& algo : algorithms) {
             arr = original;
+            bool peakReset = resetPeakRSS();
+            long rssBefore = readStatusKB("VmRSS");
+            profiler.begin();
             start = chrono::high_resolution_clock::now();
             algo.second(arr);
             end = chrono::high_resolution_clock::now();
+            PerfSample counters = profiler.end();
             duration = chrono::duration_cast<chrono::microseconds>(end - start);
+            long peakRSS = readStatusKB("VmHWM");
             
-            cout << algo.first << " took: " << duration.count() << " microseconds\n";
+            double throughput = duration.count() > 0 ? double(arr.size()) / duration.count() : 0;
+            cout << algo.first << " took: " << duration.count() << " microseconds, "
+                 << fixed << setprecision(2) << throughput << " M elements/s, extra peak RSS: ";
+            if(peakReset && rssBefore >= 0 && peakRSS >= 0)
+                cout << max(0L, peakRSS - rssBefore) << " KiB\n";
+            else
+                cout << "n/a\n";
+            if(!haveCounters) continue;
+            cout << "    " << counters.summary() << "\n";
+            for(auto& phase : profiler.phases)
+                cout << "    [" << phase.first << "] " << phase.second.summary() << "\n";
+        }
+        cout.flags(flags);
+        cout.precision(precision);
+    }
+    
+    // Record sorting test: whole records through std::stable_sort vs argsort + applyPermutation
+    void testRecordSortPerformance(int n, int seed = 42) {
+        cout << "\n=== RECORD SORTING PERFORMANCE TEST ===\n";
+        struct Record {
+            int key;
+            char payload[252];
+        };
+        mt19937 rng(seed);
+        vector<Record> original(n);
+        for(int i = 0; i < n; i++) {
+            original[i].key = rng() % 1000000;
+            memset(original[i].payload, i & 0xFF, sizeof(original[i].payload));
+        }
+        auto keyOf = [](const Record &r) { return r.key; };
+        
+        vector<pair<string, function<void(vector<Record>&)>>> algorithms = {
+            {"std::stable_sort on records", [](vector<Record>& v) {
+                stable_sort(v.begin(), v.end(), [](const Record &a, const Record &b) { return a.key < b.key; });
+            }},
+            {"Argsort (radix) + apply", [&](vector<Record>& v) { sortRecordsByKey(v, keyOf, true); }},
+            {"Argsort (merge) + apply", [&](vector<Record>& v) { sortRecordsByKey(v, keyOf, false); }}
+        };
+        
+        for(auto& algo : algorithms) {
+            vector<Record> records = original;
+            auto start = chrono::high_resolution_clock::now();
+            algo.second(records);
+            auto end = chrono::high_resolution_clock::now();
+            auto duration = chrono::duration_cast<chrono::microseconds>(end - start);
+            
+            bool sorted = is_sorted(records.begin(), records.end(), [](const Record &a, const Record &b) { return a.key < b.key; });
+            cout << algo.first << " took: " << duration.count() << " microseconds" << (sorted ? "" : " (NOT SORTED)") << "\n";
         }
     }
 };
@@ -324,8 +843,17 @@ int main() {
     arr = original; sorter.radixSort(arr);
     sorter.display(arr, "Radix Sort");
     
+    arr = original; sorter.sampleSort(arr);
+    sorter.display(arr, "Sample Sort (IPS4o)");
+    
+    vector<int> perm = sorter.argsort(original);
+    sorter.display(perm, "Argsort indices");
+    arr = original; sorter.applyPermutation(arr, perm);
+    sorter.display(arr, "Argsort + applyPermutation");
+    
     // Performance test (uncomment for larger datasets)
     // sorter.testSortingPerformance(original);
+    // sorter.testRecordSortPerformance(1000000);
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,449 @@
+/*
+ * ✅ String Sorting Algorithms Summary Table:
+ *    Sorting Type            Stable    Time Complexity (Avg/Worst)          Space Complexity    Best Use Cases
+ *    ─────────────────────────────────────────────────────────────────────────────────────────────────────────────
+ *    std::sort (comparison)  No        O(n log n · L)/O(n log n · L)        O(log n)            Few strings, short keys
+ *    Multikey Quicksort      No        O(D + n log n)/O(D + n²)             O(log n)            Small buckets, long common prefixes
+ *    MSD Radix Sort          No        O(D + n·σ)/O(D + n·σ)                O(n + σ)            Many strings (URLs, ids)
+ *    Parallel + LCP Merge    No        O(D/t + n log t)/O(D + n log t)      O(n)                Large inputs, many cores
+ *
+ *    L = average key length compared, D = distinguishing prefix (bytes that must be looked at),
+ *    σ = 256 (alphabet), t = threads
+ *
+ *    Every string is sorted through an item that keeps its next 8 bytes (big-endian) next to the
+ *    pointer, so most steps compare and bucket integers without touching the string data again.
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+class StringSortingAlgorithms {
+public:
+    static constexpr size_t kMsdThreshold = 64;            // smaller buckets go to multikey quicksort
+    static constexpr size_t kInsertionThreshold = 16;      // smaller ranges use insertion sort
+    static constexpr size_t kParallelMin = 1 << 15;        // strings per thread worth a parallel sort
+
+    struct StringItem {
+        uint64_t cache;       // 8 bytes starting at the current depth, zero padded
+        const char *str;
+        size_t len;
+    };
+
+    // All strings stored back to back in one buffer
+    struct StringArena {
+        string bytes;
+        vector<pair<size_t, size_t>> spans;    // (offset, length) of every string
+
+        void add(string_view s) {
+            spans.push_back({bytes.size(), s.size()});
+            bytes.append(s);
+        }
+
+        size_t size() const { return spans.size(); }
+
+        string_view at(size_t i) const {
+            return string_view(bytes).substr(spans[i].first, spans[i].second);
+        }
+    };
+
+    // Utility functions
+    void takeInput(int size, vector<string> &v) {
+        for(int i = 0; i < size; i++) {
+            cin >> v[i];
+        }
+    }
+
+    template<typename Strings>
+    void display(const Strings &v, const string &sortType = "") {
+        if(!sortType.empty()) {
+            cout << sortType << ": ";
+        }
+        for(int i = 0; i < v.size(); i++) {
+            cout << v[i] << " ";
+        }
+        cout << endl;
+    }
+
+    static uint64_t loadCache(const StringItem &item, size_t depth) {
+        if(item.len >= depth + 8) {
+            uint64_t word;
+            memcpy(&word, item.str + depth, 8);
+            return __builtin_bswap64(word);
+        }
+        uint64_t word = 0;
+        for(size_t i = 0; i < 8; i++) {
+            word <<= 8;
+            if(depth + i < item.len) word |= (unsigned char)item.str[depth + i];
+        }
+        return word;
+    }
+
+    static void loadCaches(StringItem *items, size_t n, size_t depth) {
+        for(size_t i = 0; i < n; i++)
+            items[i].cache = loadCache(items[i], depth);
+    }
+
+    // a < b, both known to be equal before `depth` and cached from `depth`
+    static bool lessFrom(const StringItem &a, const StringItem &b, size_t depth) {
+        if(a.cache != b.cache) return a.cache < b.cache;
+        size_t d = depth + 8;
+        if(a.len <= d || b.len <= d) return a.len < b.len;
+        return string_view(a.str + d, a.len - d) < string_view(b.str + d, b.len - d);
+    }
+
+    static vector<StringItem> makeItems(const vector<string_view> &v) {
+        vector<StringItem> items(v.size());
+        for(size_t i = 0; i < v.size(); i++)
+            items[i] = {0, v[i].data(), v[i].size()};
+        return items;
+    }
+
+    static void storeItems(const vector<StringItem> &items, vector<string_view> &v) {
+        for(size_t i = 0; i < items.size(); i++)
+            v[i] = string_view(items[i].str, items[i].len);
+    }
+
+    // 1. Multikey (three-way radix) Quicksort - partitions on 8-byte cached words
+    void insertionSortFrom(StringItem *items, size_t n, size_t depth) {
+        for(size_t i = 1; i < n; i++) {
+            StringItem key = items[i];
+            size_t j = i;
+            while(j > 0 && lessFrom(key, items[j - 1], depth)) {
+                items[j] = items[j - 1];
+                j--;
+            }
+            items[j] = key;
+        }
+    }
+
+    // Caches must hold the bytes starting at `depth`
+    void multikeyQuicksort(StringItem *items, size_t n, size_t depth) {
+        while(n > kInsertionThreshold) {
+            uint64_t a = items[0].cache, b = items[n / 2].cache, c = items[n - 1].cache;
+            uint64_t pivot = max(min(a, b), min(max(a, b), c));
+
+            size_t lt = 0, i = 0, gt = n;
+            while(i < gt) {
+                if(items[i].cache < pivot) swap(items[lt++], items[i++]);
+                else if(items[i].cache > pivot) swap(items[i], items[--gt]);
+                else i++;
+            }
+
+            // Equal words: strings ending inside this word are prefixes of the rest and
+            // order by length alone; the others continue 8 bytes deeper
+            StringItem *equal = items + lt;
+            size_t numEqual = gt - lt;
+            StringItem *longer = partition(equal, equal + numEqual,
+                                           [&](const StringItem &s) { return s.len <= depth + 8; });
+            sort(equal, longer, [](const StringItem &x, const StringItem &y) { return x.len < y.len; });
+            size_t numLonger = equal + numEqual - longer;
+            if(numLonger > 1) {
+                loadCaches(longer, numLonger, depth + 8);
+                multikeyQuicksort(longer, numLonger, depth + 8);
+            }
+
+            // Recurse into the smaller side, loop on the larger one
+            if(lt < n - gt) {
+                multikeyQuicksort(items, lt, depth);
+                items += gt;
+                n -= gt;
+            } else {
+                multikeyQuicksort(items + gt, n - gt, depth);
+                n = lt;
+            }
+        }
+        insertionSortFrom(items, n, depth);
+    }
+
+    void multikeyQuicksort(vector<string_view> &v) {
+        vector<StringItem> items = makeItems(v);
+        loadCaches(items.data(), items.size(), 0);
+        multikeyQuicksort(items.data(), items.size(), 0);
+        storeItems(items, v);
+    }
+
+    // 2. MSD Radix Sort - one byte per level, 256 buckets plus one for ended strings
+    //    The cache holds the 8 bytes from cacheDepth, so seven of eight levels read
+    //    their byte from the item itself. Buckets wait on an explicit work stack and the
+    //    largest one is sorted next, so deep inputs ("a", "aa", "aaa", ...) cannot overflow
+    //    the call stack.
+    struct MsdJob {
+        StringItem *items, *buffer;
+        size_t n, depth, cacheDepth;
+    };
+
+    void msdRadixSort(StringItem *items, StringItem *buffer, size_t n, size_t depth, size_t cacheDepth) {
+        vector<MsdJob> jobs = {{items, buffer, n, depth, cacheDepth}};
+        size_t count[257], start[258], next[257];
+        while(!jobs.empty()) {
+            MsdJob job = jobs.back();
+            jobs.pop_back();
+            while(true) {
+                if(job.n < kMsdThreshold) {
+                    if(job.cacheDepth != job.depth) loadCaches(job.items, job.n, job.depth);
+                    multikeyQuicksort(job.items, job.n, job.depth);
+                    break;
+                }
+                if(job.depth >= job.cacheDepth + 8) {
+                    loadCaches(job.items, job.n, job.depth);
+                    job.cacheDepth = job.depth;
+                }
+                int shift = 56 - 8 * (job.depth - job.cacheDepth);
+                size_t depthNow = job.depth;
+                auto bucketOf = [&](const StringItem &s) {
+                    return depthNow < s.len ? int(s.cache >> shift & 0xFF) + 1 : 0;
+                };
+
+                fill(count, count + 257, 0);
+                for(size_t i = 0; i < job.n; i++)
+                    count[bucketOf(job.items[i])]++;
+
+                // A shared prefix byte: go one level deeper without moving anything
+                int largest = max_element(count + 1, count + 257) - count;
+                if(count[0] == 0 && count[largest] == job.n) {
+                    job.depth++;
+                    continue;
+                }
+
+                start[0] = 0;
+                for(int b = 0; b < 257; b++)
+                    start[b + 1] = start[b] + count[b];
+                copy(start, start + 257, next);
+                for(size_t i = 0; i < job.n; i++)
+                    job.buffer[next[bucketOf(job.items[i])]++] = job.items[i];
+                copy(job.buffer, job.buffer + job.n, job.items);
+
+                // Bucket 0 holds the strings that end here, all equal
+                for(int b = 1; b < 257; b++)
+                    if(count[b] > 1 && b != largest)
+                        jobs.push_back({job.items + start[b], job.buffer + start[b], count[b], job.depth + 1, job.cacheDepth});
+                if(count[largest] <= 1) break;
+                job = {job.items + start[largest], job.buffer + start[largest], count[largest], job.depth + 1, job.cacheDepth};
+            }
+        }
+    }
+
+    void msdRadixSort(StringItem *items, size_t n) {
+        vector<StringItem> buffer(n);
+        loadCaches(items, n, 0);
+        msdRadixSort(items, buffer.data(), n, 0, 0);
+    }
+
+    void msdRadixSort(vector<string_view> &v) {
+        vector<StringItem> items = makeItems(v);
+        msdRadixSort(items.data(), items.size());
+        storeItems(items, v);
+    }
+
+    // 3. LCP-aware merging - equal prefixes of neighbours are never compared again
+    static size_t lcpFrom(const StringItem &a, const StringItem &b, size_t h) {
+        size_t m = min(a.len, b.len);
+        while(h < m && a.str[h] == b.str[h]) h++;
+        return h;
+    }
+
+    static void computeLcp(const StringItem *items, size_t n, size_t *lcp) {
+        if(n > 0) lcp[0] = 0;
+        for(size_t i = 1; i < n; i++)
+            lcp[i] = lcpFrom(items[i - 1], items[i], 0);
+    }
+
+    // lcpA[i] = LCP(a[i-1], a[i]); writes the merged run and its LCP array
+    static void lcpMerge(const StringItem *a, const size_t *lcpA, size_t na,
+                         const StringItem *b, const size_t *lcpB, size_t nb,
+                         StringItem *out, size_t *lcpOut) {
+        size_t i = 0, j = 0, k = 0;
+        size_t ha = 0, hb = 0;    // LCP of a[i] / b[j] with the last string written
+        while(i < na && j < nb) {
+            if(ha > hb) {
+                out[k] = a[i]; lcpOut[k++] = ha;
+                if(++i < na) ha = lcpA[i];
+            } else if(ha < hb) {
+                out[k] = b[j]; lcpOut[k++] = hb;
+                if(++j < nb) hb = lcpB[j];
+            } else {
+                size_t h = lcpFrom(a[i], b[j], ha);
+                bool aFirst = h == a[i].len || (h < b[j].len && (unsigned char)a[i].str[h] <= (unsigned char)b[j].str[h]);
+                if(aFirst) {
+                    out[k] = a[i]; lcpOut[k++] = ha;
+                    hb = h;
+                    if(++i < na) ha = lcpA[i];
+                } else {
+                    out[k] = b[j]; lcpOut[k++] = hb;
+                    ha = h;
+                    if(++j < nb) hb = lcpB[j];
+                }
+            }
+        }
+        for(; i < na; i++, ha = i < na ? lcpA[i] : 0) {
+            out[k] = a[i]; lcpOut[k++] = ha;
+        }
+        for(; j < nb; j++, hb = j < nb ? lcpB[j] : 0) {
+            out[k] = b[j]; lcpOut[k++] = hb;
+        }
+    }
+
+    // 4. Parallel top level - MSD radix sort per chunk, then a tree of LCP merges
+    static void runOnThreads(int threads, const function<void(int)> &fn) {
+        vector<thread> workers;
+        for(int t = 1; t < threads; t++)
+            workers.emplace_back(fn, t);
+        fn(0);
+        for(auto &w : workers) w.join();
+    }
+
+    void parallelStringSort(vector<string_view> &v, int threads = 0) {
+        if(threads <= 0) threads = max(1u, thread::hardware_concurrency());
+        size_t n = v.size();
+        threads = min<size_t>(threads, n / kParallelMin);
+        if(threads <= 1) {
+            msdRadixSort(v);
+            return;
+        }
+
+        vector<StringItem> items = makeItems(v), buffer(n);
+        vector<size_t> lcp(n), lcpBuffer(n);
+        vector<size_t> runs(threads + 1);
+        for(int t = 0; t <= threads; t++)
+            runs[t] = n * t / threads;
+
+        runOnThreads(threads, [&](int t) {
+            size_t begin = runs[t], size = runs[t + 1] - begin;
+            loadCaches(items.data() + begin, size, 0);
+            msdRadixSort(items.data() + begin, buffer.data() + begin, size, 0, 0);
+            computeLcp(items.data() + begin, size, lcp.data() + begin);
+        });
+
+        while(runs.size() > 2) {
+            int pairs = (runs.size() - 1) / 2;
+            runOnThreads(pairs, [&](int p) {
+                size_t a = runs[2 * p], b = runs[2 * p + 1], c = runs[2 * p + 2];
+                lcpMerge(items.data() + a, lcp.data() + a, b - a,
+                         items.data() + b, lcp.data() + b, c - b,
+                         buffer.data() + a, lcpBuffer.data() + a);
+            });
+            if((runs.size() - 1) % 2) {
+                size_t a = runs[runs.size() - 2];
+                copy(items.begin() + a, items.end(), buffer.begin() + a);
+                copy(lcp.begin() + a, lcp.end(), lcpBuffer.begin() + a);
+            }
+            items.swap(buffer);
+            lcp.swap(lcpBuffer);
+            vector<size_t> merged;
+            for(size_t r = 0; r < runs.size(); r += 2)
+                merged.push_back(runs[r]);
+            if(merged.back() != n) merged.push_back(n);
+            runs.swap(merged);
+        }
+        storeItems(items, v);
+    }
+
+    // Sorts the arena and lays its bytes out again in sorted order
+    void sortArena(StringArena &arena, int threads = 0) {
+        vector<string_view> views(arena.size());
+        for(size_t i = 0; i < arena.size(); i++)
+            views[i] = arena.at(i);
+        parallelStringSort(views, threads);
+
+        StringArena sorted;
+        sorted.bytes.reserve(arena.bytes.size());
+        sorted.spans.reserve(arena.size());
+        for(string_view s : views)
+            sorted.add(s);
+        arena = move(sorted);
+    }
+
+    // "a", "aa", ..., n times "a" in random order: every string is a prefix of the next, so
+    // the sorts have to go n bytes deep
+    static vector<string> prefixChain(int n, int seed = 42) {
+        vector<string> v(n);
+        for(int i = 0; i < n; i++)
+            v[i] = string(i + 1, 'a');
+        shuffle(v.begin(), v.end(), mt19937(seed));
+        return v;
+    }
+
+    // Performance testing function
+    void testStringSortPerformance(const vector<string> &original) {
+        cout << "\n=== STRING SORTING PERFORMANCE TEST ===\n";
+
+        vector<string_view> views(original.begin(), original.end());
+        vector<pair<string, function<void(vector<string_view>&)>>> algorithms = {
+            {"std::sort (string_view)", [](vector<string_view>& v) { sort(v.begin(), v.end()); }},
+            {"Multikey Quicksort", [this](vector<string_view>& v) { multikeyQuicksort(v); }},
+            {"MSD Radix Sort", [this](vector<string_view>& v) { msdRadixSort(v); }},
+            {"Parallel MSD + LCP Merge", [this](vector<string_view>& v) { parallelStringSort(v); }}
+        };
+
+        vector<string> strings = original;
+        auto start = chrono::high_resolution_clock::now();
+        sort(strings.begin(), strings.end());
+        auto end = chrono::high_resolution_clock::now();
+        auto duration = chrono::duration_cast<chrono::microseconds>(end - start);
+        cout << "std::sort (std::string) took: " << duration.count() << " microseconds\n";
+
+        for(auto& algo : algorithms) {
+            vector<string_view> v = views;
+            start = chrono::high_resolution_clock::now();
+            algo.second(v);
+            end = chrono::high_resolution_clock::now();
+            duration = chrono::duration_cast<chrono::microseconds>(end - start);
+
+            bool sorted = equal(v.begin(), v.end(), strings.begin());
+            cout << algo.first << " took: " << duration.count() << " microseconds" << (sorted ? "" : " (WRONG ORDER)") << "\n";
+        }
+
+        StringArena arena;
+        for(const string &s : original)
+            arena.add(s);
+        start = chrono::high_resolution_clock::now();
+        sortArena(arena);
+        end = chrono::high_resolution_clock::now();
+        duration = chrono::duration_cast<chrono::microseconds>(end - start);
+        cout << "Arena sort (with re-layout) took: " << duration.count() << " microseconds\n";
+    }
+};
+
+int main() {
+    StringSortingAlgorithms sorter;
+    int n;
+
+    // cout << "Enter number of strings: ";
+    cin >> n;
+
+    vector<string> original(n);
+    sorter.takeInput(n, original);
+
+    cout << "\nOriginal strings: ";
+    sorter.display(original);
+
+    cout << "\n=== STRING SORTING DEMONSTRATIONS ===\n";
+
+    vector<string_view> views(original.begin(), original.end());
+
+    vector<string_view> v = views; sorter.multikeyQuicksort(v);
+    sorter.display(v, "Multikey Quicksort");
+
+    v = views; sorter.msdRadixSort(v);
+    sorter.display(v, "MSD Radix Sort");
+
+    v = views; sorter.parallelStringSort(v);
+    sorter.display(v, "Parallel MSD + LCP Merge");
+
+    StringSortingAlgorithms::StringArena arena;
+    for(const string &s : original)
+        arena.add(s);
+    sorter.sortArena(arena);
+    cout << "Arena Sort: ";
+    for(size_t i = 0; i < arena.size(); i++)
+        cout << arena.at(i) << " ";
+    cout << endl;
+
+    // Deep input: one long shared prefix, a new bucket at every level
+    sorter.testStringSortPerformance(StringSortingAlgorithms::prefixChain(2000));
+
+    // Performance test (uncomment for larger datasets)
+    // sorter.testStringSortPerformance(original);
+
+    return 0;
+}